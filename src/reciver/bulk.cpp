@@ -0,0 +1,77 @@
+#include "bulk.h"
+
+void Bulk::reset() {
+  memset(coefs, 0, sizeof(coefs));
+  length = 0;
+  packets = 0;
+  dropped = 0;
+  rank = 0;
+}
+
+void Bulk::xorBlock(byte* target, const byte* source) {
+  for (uint8_t i = 0; i < FOUNTAIN_BLOCK_SIZE; i++) {
+    target[i] ^= source[i];
+  }
+}
+
+bool Bulk::addPacket(byte packet[FOUNTAIN_PACKET_SIZE]) {
+  // Check before touching any state, a bad length would reset the transfer
+  uint16_t crc = packet[FOUNTAIN_CRC_OFFSET] | (packet[FOUNTAIN_CRC_OFFSET + 1] << 8);
+  if (crc != fountainCrc(packet, FOUNTAIN_CRC_OFFSET)) {
+    dropped++;
+    return isComplete();
+  }
+  uint16_t seed = packet[0] | (packet[1] << 8);
+  uint16_t dataLength = packet[2] | (packet[3] << 8);
+  if (dataLength == 0 || dataLength > FOUNTAIN_MAX_LENGTH) {
+    return isComplete();
+  }
+  if (dataLength != length) {
+    reset();
+    length = dataLength;
+  }
+  uint8_t count = fountainBlockCount(length);
+  if (rank == count) {
+    return true;
+  }
+  packets++;
+
+  /*
+  On-the-fly Gaussian elimination over GF(2). Eliminate source blocks already
+  owned by stored rows from the new packet. The first block left without an
+  owner makes the packet a new row, if nothing is left the packet was redundant.
+  Unlike a peeling decoder this never needs to buffer packets waiting for
+  a degree-one neighbour, and it uses every independent packet.
+  */
+  uint32_t coef = fountainCoefficients(seed, count);
+  byte* block = packet + FOUNTAIN_HEADER_SIZE;
+  for (uint8_t i = 0; i < count; i++) {
+    if (!(coef & (1UL << i))) {
+      continue;
+    }
+    if (coefs[i]) {
+      coef ^= coefs[i];
+      xorBlock(block, blocks[i]);
+    }
+    else {
+      coefs[i] = coef;
+      memcpy(blocks[i], block, FOUNTAIN_BLOCK_SIZE);
+      rank++;
+      break;
+    }
+  }
+  if (rank < count) {
+    return false;
+  }
+
+  // All rows filled, back-substitute from the last row to get plain source blocks
+  for (int8_t i = count - 1; i >= 0; i--) {
+    for (uint8_t j = i + 1; j < count; j++) {
+      if (coefs[i] & (1UL << j)) {
+        coefs[i] ^= coefs[j];
+        xorBlock(blocks[i], blocks[j]);
+      }
+    }
+  }
+  return true;
+}
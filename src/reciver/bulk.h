@@ -0,0 +1,79 @@
+#ifndef BULK_H_INCLUDED
+#define BULK_H_INCLUDED
+
+#include <Arduino.h>
+#include "fountain.h"
+
+/*!
+  @brief   Class for receiving fountain-coded bulk data.
+  @details Recovers the data sent by Sender::nextFountainPacket(). Packets can
+           arrive in any order and lost ones are never needed. Takes ~650 bytes
+           of RAM, so create it only in sketches using the bulk transfer.
+*/
+class Bulk {
+  public:
+    /*!
+      @brief   Initializes the decoder.
+    */
+    void init() { reset(); }
+
+    /*!
+      @brief   Adds a received packet to the decoder.
+      @details A packet with a different data length starts a new transfer,
+               call reset() before a new transfer of the same length.
+               The packet buffer is used as scratch space and gets modified.
+               Packets with a wrong CRC are dropped without changing the state.
+      @param   packet Received packet (size FOUNTAIN_PACKET_SIZE).
+      @return  True when the whole data has been recovered.
+    */
+    bool addPacket(byte packet[FOUNTAIN_PACKET_SIZE]);
+
+    /*!
+      @brief   Checks if the data has been recovered.
+      @return  True when the whole data has been recovered.
+    */
+    bool isComplete() { return length > 0 && rank == fountainBlockCount(length); }
+
+    /*!
+      @brief   Gets the recovered data, valid when isComplete().
+      @return  Pointer to the data (size getLength()).
+    */
+    const byte* getData() { return blocks[0]; }
+
+    /*!
+      @brief   Gets the length of the data.
+      @return  Data length in bytes, 0 if no transfer started.
+    */
+    uint16_t getLength() { return length; }
+
+    /*!
+      @brief   Gets the count of packets used by the current transfer.
+      @return  Packets added since the transfer started, including redundant ones.
+    */
+    uint16_t getPacketCount() { return packets; }
+
+    /*!
+      @brief   Gets the count of packets dropped for a wrong CRC.
+      @return  Packets dropped since the last reset().
+    */
+    uint16_t getDroppedCount() { return dropped; }
+
+    /*!
+      @brief   Drops the decoder state and waits for a new transfer.
+    */
+    void reset();
+
+  private:
+    // Row i holds a coded block whose lowest source block is i, 0 if row is empty
+    uint32_t coefs[FOUNTAIN_MAX_BLOCKS];
+    // After decoding row i holds source block i, so the rows are the data itself
+    byte blocks[FOUNTAIN_MAX_BLOCKS][FOUNTAIN_BLOCK_SIZE];
+    uint16_t length = 0;
+    uint16_t packets = 0;
+    uint16_t dropped = 0;
+    uint8_t rank = 0; // Number of filled rows
+
+    void xorBlock(byte* target, const byte* source);
+};
+
+#endif // BULK_H_INCLUDED
@@ -0,0 +1,159 @@
+#include "dashboard.h"
+
+void Dashboard::init(Display* display) {
+  this->display = display;
+  fieldCount = 0;
+  lastRefresh = 0;
+  windowStart = millis();
+  windowSpent = 0;
+}
+
+int8_t Dashboard::addField(int16_t col, int16_t row, const char* label, uint8_t width) {
+  if (fieldCount >= DASHBOARD_FIELDS || width == 0 || width > DASHBOARD_FIELD_CHARS) {
+    return -1;
+  }
+  if (label != NULL) {
+    for (; *label; label++) {
+      drawGlyph(col, row, *label);
+      col += F_SIZE*6;
+    }
+  }
+
+  Field& f = fields[fieldCount];
+  f.col = col;
+  f.row = row;
+  f.width = width;
+  f.dirty = true;
+  for (uint8_t i = 0; i < width; i++) {
+    f.shown[i] = 0; // Unknown content, first refresh draws every glyph
+    f.wanted[i] = ' ';
+  }
+  return fieldCount++;
+}
+
+void Dashboard::setInteger(uint8_t field, int32_t value) {
+  if (field >= fieldCount) {
+    return;
+  }
+  Field& f = fields[field];
+  // Format from the right end without String
+  bool negative = value < 0;
+  uint32_t n = negative ? -(uint32_t)value : value;
+  int8_t i = f.width - 1;
+  do {
+    f.wanted[i--] = '0' + n % 10;
+    n /= 10;
+  } while (n && i >= 0);
+  if (negative) {
+    if (i >= 0) {
+      f.wanted[i--] = '-';
+    }
+    else {
+      n = 1; // No room for the sign
+    }
+  }
+  if (n) {
+    i = f.width - 1; // Doesn't fit, fill the whole field
+  }
+  for (; i >= 0; i--) {
+    f.wanted[i] = n ? '*' : ' ';
+  }
+  f.dirty = true;
+}
+
+void Dashboard::setText(uint8_t field, const char* text) {
+  if (field >= fieldCount) {
+    return;
+  }
+  Field& f = fields[field];
+  for (uint8_t i = 0; i < f.width; i++) {
+    char c = *text ? *text++ : ' ';
+    f.wanted[i] = ((uint8_t)c < 0x20 || (uint8_t)c > 0x7f) ? '?' : c;
+  }
+  f.dirty = true;
+}
+
+void Dashboard::setRefreshLimits(uint16_t interval, uint32_t budget) {
+  refreshInterval = interval;
+  refreshBudget = budget;
+}
+
+bool Dashboard::refresh() {
+  unsigned long now = millis();
+  if (now - lastRefresh < refreshInterval) {
+    return !isDirty();
+  }
+  if (now - windowStart >= 1000) {
+    windowStart = now;
+    windowSpent = 0;
+  }
+  lastRefresh = now;
+
+  for (uint8_t n = 0; n < fieldCount; n++) {
+    Field& f = fields[n];
+    if (!f.dirty) {
+      continue;
+    }
+    for (uint8_t i = 0; i < f.width; i++) {
+      if (f.shown[i] == f.wanted[i]) {
+        continue;
+      }
+      // Stop before a glyph that could overrun the budget, rest stays dirty
+      if (windowSpent + glyphTime > refreshBudget) {
+        return false;
+      }
+      unsigned long start = micros();
+      drawGlyph(f.col + i*F_SIZE*6, f.row, f.wanted[i]);
+      uint16_t spent = micros() - start;
+      windowSpent += spent;
+      if (spent > glyphTime) {
+        glyphTime = spent;
+      }
+      f.shown[i] = f.wanted[i];
+    }
+    f.dirty = false;
+  }
+  return true;
+}
+
+bool Dashboard::isDirty() {
+  for (uint8_t n = 0; n < fieldCount; n++) {
+    Field& f = fields[n];
+    if (!f.dirty) {
+      continue;
+    }
+    if (memcmp(f.shown, f.wanted, f.width) != 0) {
+      return true;
+    }
+    f.dirty = false; // Set to the value already shown
+  }
+  return false;
+}
+
+void Dashboard::drawGlyph(int16_t col, int16_t row, char c) {
+  /*
+  One window for the whole glyph cell, then runs of foreground and background
+  pixels per glyph column. The 6th column is the gap to the next glyph.
+  Much cheaper than displayChar, which sets LCD_RS and both data ports for
+  every byte of every pixel.
+  */
+  uint8_t size = F_SIZE;
+  display->setWindow(col, row, size*6, size*8);
+  for (uint8_t index = 0; index < 6; index++) {
+    byte bits = index < 5 ? display->glyphColumn(c, index) : 0;
+    for (uint8_t i = 0; i < size; i++) {
+      byte mask = 1;
+      uint8_t nbit = 0;
+      while (nbit < 8) {
+        bool on = bits & mask;
+        uint8_t run = 0;
+        while (nbit < 8 && (bool)(bits & mask) == on) {
+          run++;
+          nbit++;
+          mask = mask << 1;
+        }
+        display->writePixels(on ? F_COLOR : B_COLOR, run*size);
+      }
+    }
+  }
+}
@@ -0,0 +1,103 @@
+#ifndef DASHBOARD_H_INCLUDED
+#define DASHBOARD_H_INCLUDED
+
+#include <Arduino.h>
+#include "display.h"
+
+#define DASHBOARD_FIELDS 6 // Max fields on the dashboard
+#define DASHBOARD_FIELD_CHARS 8 // Max chars in one field
+
+/*!
+  @brief   Class for live values on the display.
+  @details Fields have fixed positions and remember the chars currently shown,
+           so a refresh redraws only the glyphs that changed. Drawing is limited
+           by a CPU budget per second to leave time for receiving data.
+*/
+class Dashboard {
+  public:
+    /*! Font size of the fields */
+    uint8_t F_SIZE=2;
+    /*! Foreground color of the fields */
+    uint16_t F_COLOR=BLACK;
+    /*! Background color of the fields */
+    uint16_t B_COLOR=WHITE;
+
+    /*!
+      @brief   Initializes the dashboard.
+      @param   display Initialized display to draw on.
+    */
+    void init(Display* display);
+
+    /*!
+      @brief   Adds a field and draws its label once.
+      @param   col The column position of the label.
+      @param   row The row position of the label.
+      @param   label Static text before the field, may be NULL.
+      @param   width Field width in chars (max DASHBOARD_FIELD_CHARS).
+      @return  Field index, -1 if there is no room for the field.
+    */
+    int8_t addField(int16_t col, int16_t row, const char* label, uint8_t width);
+
+    /*!
+      @brief   Sets an integer value of the field, right aligned.
+      @details Nothing is drawn until refresh(). Too long values are shown as '*'.
+      @param   field Field index.
+      @param   value The integer value to display.
+    */
+    void setInteger(uint8_t field, int32_t value);
+
+    /*!
+      @brief   Sets a text of the field, left aligned.
+      @details Nothing is drawn until refresh(). Too long text is cut.
+      @param   field Field index.
+      @param   text The text to display.
+    */
+    void setText(uint8_t field, const char* text);
+
+    /*!
+      @brief   Sets the refresh limits.
+      @param   interval (ms) Minimal time between two refreshes.
+      @param   budget (us) Max drawing time per second.
+    */
+    void setRefreshLimits(uint16_t interval, uint32_t budget);
+
+    /*!
+      @brief   Redraws changed glyphs, call it often from the loop.
+      @details Returns right away if the interval hasn't elapsed or the budget
+               for the current second is spent. Glyphs left undrawn stay dirty
+               for the next call.
+      @return  True if everything shown is up to date.
+    */
+    bool refresh();
+
+  private:
+    struct Field {
+      int16_t col;
+      int16_t row;
+      uint8_t width;
+      bool dirty;
+      char shown[DASHBOARD_FIELD_CHARS]; // Chars on the screen
+      char wanted[DASHBOARD_FIELD_CHARS]; // Chars to be shown
+    };
+
+    Display* display;
+    Field fields[DASHBOARD_FIELDS];
+    uint8_t fieldCount = 0;
+
+    uint16_t refreshInterval = 100; // (ms) 10 refreshes per second
+    uint32_t refreshBudget = 50000; // (us) 5% of CPU time
+    unsigned long lastRefresh = 0; // (ms)
+    unsigned long windowStart = 0; // (ms) Start of the current budget second
+    uint32_t windowSpent = 0; // (us) Drawing time in the current budget second
+    uint16_t glyphTime = 0; // (us) Longest glyph drawing time seen
+
+    /*!
+      @brief   Checks if any field has glyphs waiting to be drawn.
+      @return  True if some shown char differs from the wanted one.
+    */
+    bool isDirty();
+
+    void drawGlyph(int16_t col, int16_t row, char c);
+};
+
+#endif // DASHBOARD_H_INCLUDED
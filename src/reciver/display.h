@@ -59,6 +59,9 @@ public:
   /*! Background color */
   uint16_t B_COLOR=WHITE;
 
+  /*! Incremented by every Memory Write command, tells that a window was replaced */
+  uint16_t W_SERIAL=0;
+
   /*!
     @brief Initialize the display.
    */
@@ -74,6 +77,23 @@ public:
    */
   void rect(int16_t col, int16_t row, int16_t width, int16_t height, int16_t color);
 
+  /*!
+    @brief Set the drawing window and start writing pixels into it.
+    @details Pixels fill the window from the top row down, then the next column.
+    @param col The column position of the top-left corner of the window.
+    @param row The row position of the top-left corner of the window.
+    @param width The width of the window.
+    @param height The height of the window.
+   */
+  void setWindow(int16_t col, int16_t row, int16_t width, int16_t height);
+
+  /*!
+    @brief Write pixels of one color into the window set by setWindow.
+    @param color The color of the pixels.
+    @param count The number of pixels.
+   */
+  void writePixels(uint16_t color, uint16_t count);
+
   /*!
     @brief Clear the display.
     @param color The color to fill the display with.
@@ -98,6 +118,14 @@ public:
    */
   void displayChar(char simbol);
 
+  /*!
+    @brief Get one column of a character from the font.
+    @param simbol The character (0x20 - 0x7f).
+    @param index The glyph column (0 - 4).
+    @return Pixels of the column, bit 0 is the top row.
+   */
+  byte glyphColumn(char simbol, byte index);
+
   /*!
     @brief Clear a specified number of characters from the display.
     @param n The number of characters to clear.
@@ -0,0 +1,75 @@
+#include "image.h"
+
+void Image::begin(int16_t col, int16_t row) {
+  this->col = col;
+  this->row = row;
+  width = 0;
+  height = 0;
+  x = 0;
+  y = 0;
+  windowLeft = 0;
+  received = 0;
+  runByte = 0;
+}
+
+bool Image::write(byte b) {
+  if (received < RLE_HEADER_SIZE) {
+    if (received < 2) {
+      width |= (uint16_t)b << (8 * received);
+    }
+    else {
+      height |= (uint16_t)b << (8 * (received - 2));
+    }
+    received++;
+    // Compare without sums, int16_t + uint16_t wraps in 16 bits on AVR
+    if (received == RLE_HEADER_SIZE
+        && (height == 0 || col < 0 || row < 0 || col > 320 || row > 240
+          || width > 320 - col || height > 240 - row)) {
+      x = width; // Nothing to draw, ignore the rest of the stream
+    }
+    return isComplete();
+  }
+  if (isComplete()) {
+    return true;
+  }
+
+  if (runByte == 0) {
+    runLength = (uint16_t)b + 1;
+  }
+  else if (runByte == 1) {
+    colorHigh = b;
+  }
+  else {
+    writeRun(((uint16_t)colorHigh << 8) | b, runLength);
+  }
+  runByte = (runByte + 1) % RLE_RUN_SIZE;
+  return isComplete();
+}
+
+void Image::writeRun(uint16_t color, uint16_t count) {
+  while (count > 0 && x < width) {
+    if (windowLeft == 0 || display->W_SERIAL != serial) {
+      // Reopen the window at the current pixel, the rest of a started column first
+      if (y > 0) {
+        display->setWindow(col + x, row + y, 1, height - y);
+        windowLeft = height - y;
+      }
+      else {
+        display->setWindow(col + x, row, width - x, height);
+        windowLeft = (uint32_t)(width - x) * height;
+      }
+      serial = display->W_SERIAL;
+    }
+
+    uint16_t n = count < windowLeft ? count : windowLeft;
+    display->writePixels(color, n);
+    windowLeft -= n;
+    count -= n;
+
+    y += n;
+    if (y >= height) {
+      x += y / height;
+      y %= height;
+    }
+  }
+}
@@ -0,0 +1,63 @@
+#ifndef IMAGE_H_INCLUDED
+#define IMAGE_H_INCLUDED
+
+#include <Arduino.h>
+#include "display.h"
+#include "rle.h"
+
+/*!
+  @brief   Class for drawing received run-length encoded images.
+  @details Bytes are decoded as they arrive and each run goes straight into
+           the display memory, so no image buffer is needed. Other drawing
+           between two bytes is allowed, the window is reopened when needed.
+*/
+class Image {
+  public:
+    /*!
+      @brief   Initializes the image decoder.
+      @param   display Initialized display to draw on.
+    */
+    void init(Display* display) { this->display = display; }
+
+    /*!
+      @brief   Starts decoding a new image.
+      @param   col The column position of the top-left corner of the image.
+      @param   row The row position of the top-left corner of the image.
+    */
+    void begin(int16_t col, int16_t row);
+
+    /*!
+      @brief   Decodes the next byte of the image stream.
+      @details Images not fitting on the screen are skipped.
+      @param   b Received byte.
+      @return  True when the whole image has been drawn.
+    */
+    bool write(byte b);
+
+    /*!
+      @brief   Checks if the image has been drawn.
+      @return  True when the whole image has been drawn.
+    */
+    bool isComplete() { return received >= RLE_HEADER_SIZE && x >= width; }
+
+  private:
+    Display* display;
+    int16_t col;
+    int16_t row;
+    uint16_t width;
+    uint16_t height;
+
+    uint16_t x; // Position of the next pixel in the image
+    uint16_t y;
+    uint32_t windowLeft; // Pixels left in the opened window
+    uint16_t serial; // W_SERIAL of the display after the window was opened
+
+    uint8_t received; // Bytes of the header received
+    uint8_t runByte; // Next byte of the current run
+    uint16_t runLength;
+    byte colorHigh;
+
+    void writeRun(uint16_t color, uint16_t count);
+};
+
+#endif // IMAGE_H_INCLUDED
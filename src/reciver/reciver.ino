@@ -1,4 +1,7 @@
 #include "display.h"
+#include "dashboard.h"
+#include "scope.h"
+#include "image.h"
 #include "reciver.h"
 
 Reciver reciver; // Create an instance of the Reciver class
@@ -6,11 +9,20 @@ Reciver reciver; // Create an instance of the Reciver class
 // Display works only on Arduino platform
 #ifdef USE_ARDUINO
 Display display; // Create an instance of the Display class
+Dashboard dashboard; // Create an instance of the Dashboard class
+Scope scope; // Create an instance of the Scope class
+Image image; // Create an instance of the Image class
+
+// Dashboard fields with link stats
+int8_t fieldBytes, fieldRate, fieldErrors, fieldSignal;
 #endif
 
 
 void reciveData() {
   // Your transmitted protocol here
+  // Update link stats, e.g. dashboard.setInteger(fieldBytes, bytesReceived);
+  // Draw received images, e.g. image.begin(col, row) and image.write(b) for each byte
+  // Receive bulk data with a Bulk instance (bulk.h), e.g. bulk.addPacket(packet)
 }
 
 void setup() {
@@ -22,6 +34,17 @@ void setup() {
   display.F_COLOR=RED; // Change text color to RED
   display.B_COLOR=YELLOW; // Change background text color to YELLOW
   display.displayString("<[Reciver is ready!]>"); // Display a message indicating that the reciver is ready
+
+  dashboard.init(&display); // Initializing the dashboard
+  fieldBytes = dashboard.addField(4, 200, "Bytes:", 8); // Label and 8 chars wide value
+  fieldRate = dashboard.addField(4, 218, "Bit/s:", 8);
+  fieldErrors = dashboard.addField(176, 200, "Errs:", 6);
+  fieldSignal = dashboard.addField(176, 218, "Sig: ", 6);
+
+  scope.init(&display, 4, 24, 312, 168); // Waveform between the message and the dashboard
+  scope.setThreshold(512); // Set your protocol decision threshold
+
+  image.init(&display); // Initializing the image decoder
   #endif
   /*---- End of setup ----*/
 
@@ -33,4 +56,11 @@ void setup() {
 
 void loop() {
   reciver.start(); // Starts the Reciver functionality.
+
+  #ifdef USE_ARDUINO
+  int16_t signal = reciver.getSignal();
+  scope.addSample(signal); // Draws one new column ~30 times per second
+  dashboard.setInteger(fieldSignal, signal); // Only memory write, nothing is drawn
+  dashboard.refresh(); // Redraw changed digits if the time budget allows
+  #endif
 }
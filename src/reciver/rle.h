@@ -0,0 +1,22 @@
+#ifndef RLE_H_INCLUDED
+#define RLE_H_INCLUDED
+
+// Run-length encoded RGB565 image, shared by sender and reciver.
+// Keep sender/rle.h and reciver/rle.h identical.
+
+// Stream layout:
+// byte 0-1 -- image width (low, high)
+// byte 2-3 -- image height (low, high)
+// then runs until width*height pixels:
+// byte 0   -- run length - 1 (1 - 256 pixels)
+// byte 1-2 -- RGB565 color (high, low)
+
+// Pixels go column by column, each column from the top down. It is the order
+// the display fills its address window in, so reciver writes runs straight
+// into the display memory. Sender reads row-major images and reorders them.
+
+#define RLE_HEADER_SIZE 4
+#define RLE_RUN_SIZE 3
+#define RLE_MAX_RUN 256
+
+#endif // RLE_H_INCLUDED
@@ -0,0 +1,97 @@
+#include "scope.h"
+
+void Scope::init(Display* display, int16_t col, int16_t row, int16_t width, int16_t height) {
+  this->display = display;
+  plotCol = col;
+  plotRow = row;
+  plotWidth = width;
+  plotHeight = height;
+  cursor = 0;
+  envCount = 0;
+  lastFrame = millis();
+  display->rect(col, row, width, height, B_COLOR);
+}
+
+void Scope::setRange(int16_t low, int16_t high) {
+  if (high <= low) {
+    return;
+  }
+  rangeLow = low;
+  rangeHigh = high;
+}
+
+void Scope::setRate(uint16_t samples, uint16_t interval) {
+  decimation = samples ? samples : 1;
+  frameInterval = interval;
+}
+
+bool Scope::addSample(int16_t value) {
+  if (envCount == 0) {
+    envMin = value;
+    envMax = value;
+  }
+  else if (value < envMin) {
+    envMin = value;
+  }
+  else if (value > envMax) {
+    envMax = value;
+  }
+  if (envCount < 0xFFFF) {
+    envCount++;
+  }
+
+  unsigned long now = millis();
+  if (envCount < decimation || now - lastFrame < frameInterval) {
+    return false;
+  }
+  lastFrame = now;
+
+  // Higher signal is drawn higher, so the top of the span is the maximum
+  drawColumn(cursor, valueToY(envMax), valueToY(envMin), F_COLOR);
+  envCount = 0;
+  cursor++;
+  if (cursor >= plotWidth) {
+    cursor = 0;
+  }
+  // Cursor column erases the oldest envelope and shows the sweep position
+  drawColumn(cursor, 0, -1, C_COLOR);
+  return true;
+}
+
+int16_t Scope::valueToY(int16_t value) {
+  if (value <= rangeLow) {
+    return plotHeight - 1;
+  }
+  if (value >= rangeHigh) {
+    return 0;
+  }
+  // Each operand in 32 bits, a range wider than 32767 overflows int16_t
+  return ((int32_t)rangeHigh - value) * (plotHeight - 1) / ((int32_t)rangeHigh - rangeLow);
+}
+
+void Scope::drawColumn(int16_t x, int16_t yTop, int16_t yBottom, uint16_t color) {
+  // One window for the whole column, then only runs of pixels top to bottom
+  int16_t yThreshold = (threshold >= rangeLow && threshold <= rangeHigh) ? valueToY(threshold) : -1;
+  display->setWindow(plotCol + x, plotRow, 1, plotHeight);
+  if (yBottom < yTop) {
+    // Empty span, column of one color
+    drawRun(color, 0, plotHeight, yThreshold);
+    return;
+  }
+  drawRun(B_COLOR, 0, yTop, yThreshold);
+  drawRun(color, yTop, yBottom + 1, yThreshold);
+  drawRun(B_COLOR, yBottom + 1, plotHeight, yThreshold);
+}
+
+void Scope::drawRun(uint16_t color, int16_t from, int16_t to, int16_t yThreshold) {
+  if (to <= from) {
+    return;
+  }
+  if (yThreshold < from || yThreshold >= to) {
+    display->writePixels(color, to - from);
+    return;
+  }
+  display->writePixels(color, yThreshold - from);
+  display->writePixels(T_COLOR, 1);
+  display->writePixels(color, to - yThreshold - 1);
+}
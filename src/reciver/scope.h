@@ -0,0 +1,88 @@
+#ifndef SCOPE_H_INCLUDED
+#define SCOPE_H_INCLUDED
+
+#include <Arduino.h>
+#include "display.h"
+
+/*!
+  @brief   Class for a live waveform of the received signal.
+  @details Samples are decimated into min/max envelopes, one envelope per screen
+           column. The plot is swept from left to right like on a heart monitor,
+           each frame draws only the new column and a cursor column ahead of it.
+*/
+class Scope {
+  public:
+    /*! Envelope color */
+    uint16_t F_COLOR=GREEN;
+    /*! Background color, colors with equal high and low byte draw fastest */
+    uint16_t B_COLOR=BLACK;
+    /*! Threshold line color */
+    uint16_t T_COLOR=RED;
+    /*! Sweep cursor color */
+    uint16_t C_COLOR=WHITE;
+
+    /*!
+      @brief   Initializes the scope and clears the plot area.
+      @param   display Initialized display to draw on.
+      @param   col The column position of the top-left corner of the plot.
+      @param   row The row position of the top-left corner of the plot.
+      @param   width The width of the plot (number of envelope columns).
+      @param   height The height of the plot.
+    */
+    void init(Display* display, int16_t col, int16_t row, int16_t width, int16_t height);
+
+    /*!
+      @brief   Sets the signal values at the bottom and the top of the plot.
+      @param   low Signal value at the bottom of the plot.
+      @param   high Signal value at the top of the plot.
+    */
+    void setRange(int16_t low, int16_t high);
+
+    /*!
+      @brief   Sets the decision threshold drawn over the plot.
+      @param   threshold Signal value of the threshold.
+    */
+    void setThreshold(int16_t threshold) { this->threshold = threshold; }
+
+    /*!
+      @brief   Sets how often a new column is drawn.
+      @param   samples Minimal number of samples in one column.
+      @param   interval (ms) Minimal time between two columns.
+    */
+    void setRate(uint16_t samples, uint16_t interval);
+
+    /*!
+      @brief   Adds a sample to the current envelope.
+      @details Draws the column when both limits of setRate() are reached,
+               otherwise it only updates min and max.
+      @param   value Signal value, e.g. Reciver::getSignal().
+      @return  True if a new column was drawn.
+    */
+    bool addSample(int16_t value);
+
+  private:
+    Display* display;
+    int16_t plotCol;
+    int16_t plotRow;
+    int16_t plotWidth;
+    int16_t plotHeight;
+
+    int16_t rangeLow = 0;
+    int16_t rangeHigh = 1023;
+    int16_t threshold = -1; // Outside of the range, not drawn
+
+    uint16_t decimation = 1; // Minimal samples in one column
+    uint16_t frameInterval = 33; // (ms) ~30 columns per second
+    unsigned long lastFrame = 0; // (ms)
+
+    int16_t cursor = 0; // Column to be drawn next
+    int16_t envMin;
+    int16_t envMax;
+    uint16_t envCount = 0;
+
+    int16_t valueToY(int16_t value);
+    void drawColumn(int16_t x, int16_t yTop, int16_t yBottom, uint16_t color);
+    void drawRun(uint16_t color, int16_t from, int16_t to, int16_t yThreshold);
+};
+
+#endif // SCOPE_H_INCLUDED
@@ -0,0 +1,76 @@
+#ifndef FOUNTAIN_H_INCLUDED
+#define FOUNTAIN_H_INCLUDED
+
+#include <Arduino.h>
+
+// Fountain-coded bulk transfer, shared by sender and reciver.
+// Keep sender/fountain.h and reciver/fountain.h identical.
+
+// Packet layout:
+// byte 0-1 -- seed (low, high), selects the source blocks of the coded block
+// byte 2-3 -- data length in bytes (low, high)
+// byte 4-  -- coded block, XOR of the selected source blocks (FOUNTAIN_BLOCK_SIZE bytes)
+// last 2   -- CRC-16 of all bytes before it (low, high)
+
+#define FOUNTAIN_BLOCK_SIZE 16 // Bytes in one block
+#define FOUNTAIN_MAX_BLOCKS 32 // Max source blocks, one bit of uint32_t per block
+#define FOUNTAIN_MAX_LENGTH (FOUNTAIN_BLOCK_SIZE * FOUNTAIN_MAX_BLOCKS) // 512 bytes
+#define FOUNTAIN_HEADER_SIZE 4
+#define FOUNTAIN_CRC_OFFSET (FOUNTAIN_HEADER_SIZE + FOUNTAIN_BLOCK_SIZE)
+#define FOUNTAIN_PACKET_SIZE (FOUNTAIN_CRC_OFFSET + 2)
+
+/*!
+  @brief   Number of source blocks for the data length.
+  @param   length Data length in bytes.
+  @return  Number of blocks, the last one is padded with zeros.
+*/
+inline uint8_t fountainBlockCount(uint16_t length) {
+  return (length + FOUNTAIN_BLOCK_SIZE - 1) / FOUNTAIN_BLOCK_SIZE;
+}
+
+/*!
+  @brief   Source blocks combined into the coded block with given seed.
+  @details First seeds are systematic (block i is sent as is), so a clean link
+           needs no extra packets. Later seeds pick a pseudo-random subset of
+           the blocks. Both sides derive the subset from the seed, so only the
+           seed goes over the link.
+  @param   seed Sequence number of the coded block.
+  @param   blocks Number of source blocks (1 - FOUNTAIN_MAX_BLOCKS).
+  @return  Bit i set when source block i is XORed into the coded block.
+*/
+inline uint32_t fountainCoefficients(uint16_t seed, uint8_t blocks) {
+  if (seed < blocks) {
+    return 1UL << seed;
+  }
+  // murmur3 fmix32, its multiplies make neighbouring seeds give unrelated
+  // subsets (a pure shift/xor mixer is linear and the rows come out dependent)
+  uint32_t x = seed + 0x9E3779B9UL;
+  x ^= x >> 16;
+  x *= 0x85EBCA6BUL;
+  x ^= x >> 13;
+  x *= 0xC2B2AE35UL;
+  x ^= x >> 16;
+  if (blocks < 32) {
+    x &= (1UL << blocks) - 1;
+  }
+  return x ? x : 1UL << (seed % blocks);
+}
+
+/*!
+  @brief   CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF).
+  @param   data Bytes to check.
+  @param   length Number of bytes.
+  @return  CRC of the bytes.
+*/
+inline uint16_t fountainCrc(const byte* data, uint8_t length) {
+  uint16_t crc = 0xFFFF;
+  for (uint8_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+#endif // FOUNTAIN_H_INCLUDED
@@ -1,6 +1,15 @@
 #include "sender.h"
 #include "Arduino.h"
 
+#ifdef USE_ARDUINO
+#include <avr/sleep.h>
+
+// Wake-up only, sleepUntilButton() does the rest
+ISR(ANALOG_COMP_vect) {
+  ACSR &= ~_BV(ACIE);
+}
+#endif
+
 void Sender::init() {
   pinMode(btnPin, INPUT); // Analog pin
   pinMode(laserPin, OUTPUT); // Digital pin
@@ -50,6 +59,157 @@ bool Sender::isKeyboardButtonPressed(unsigned long currentMillis, unsigned long
     && currentMillis - previousMillis > debounceDelay;
 }
 
+bool Sender::setFountainData(const byte* data, uint16_t length) {
+  if (data == NULL || length == 0 || length > FOUNTAIN_MAX_LENGTH) {
+    return false;
+  }
+  fountainData = data;
+  fountainLength = length;
+  fountainSeed = 0;
+  return true;
+}
+
+bool Sender::nextFountainPacket(byte packet[FOUNTAIN_PACKET_SIZE]) {
+  if (fountainLength == 0) {
+    return false;
+  }
+  uint8_t blocks = fountainBlockCount(fountainLength);
+  uint32_t coef = fountainCoefficients(fountainSeed, blocks);
+
+  packet[0] = fountainSeed;
+  packet[1] = fountainSeed >> 8;
+  packet[2] = fountainLength;
+  packet[3] = fountainLength >> 8;
+
+  // XOR selected source blocks, bytes past the data end count as zeros
+  byte* block = packet + FOUNTAIN_HEADER_SIZE;
+  memset(block, 0, FOUNTAIN_BLOCK_SIZE);
+  for (uint8_t i = 0; i < blocks; i++) {
+    if (!(coef & (1UL << i))) {
+      continue;
+    }
+    uint16_t offset = i * FOUNTAIN_BLOCK_SIZE;
+    for (uint8_t j = 0; j < FOUNTAIN_BLOCK_SIZE && offset + j < fountainLength; j++) {
+      block[j] ^= fountainData[offset + j];
+    }
+  }
+
+  uint16_t crc = fountainCrc(packet, FOUNTAIN_CRC_OFFSET);
+  packet[FOUNTAIN_CRC_OFFSET] = crc;
+  packet[FOUNTAIN_CRC_OFFSET + 1] = crc >> 8;
+
+  fountainSeed++;
+  return true;
+}
+
+bool Sender::setImage(const uint16_t* pixels, uint16_t width, uint16_t height) {
+  if (pixels == NULL || width == 0 || height == 0) {
+    return false;
+  }
+  imagePixels = pixels;
+  imageWidth = width;
+  imageHeight = height;
+  imageX = 0;
+  imageY = 0;
+  imageNext = pixels;
+  imageRun = 0;
+  imageHeader = 0;
+  imageByte = 0;
+  return true;
+}
+
+void Sender::nextImagePixel() {
+  // Down the column, then to the top of the next one, no division needed
+  imageY++;
+  imageNext += imageWidth;
+  if (imageY == imageHeight) {
+    imageY = 0;
+    imageX++;
+    imageNext = imagePixels + imageX;
+  }
+}
+
+int16_t Sender::nextImageByte() {
+  if (imagePixels == NULL) {
+    return -1;
+  }
+  if (imageHeader < RLE_HEADER_SIZE) {
+    uint16_t value = imageHeader < 2 ? imageWidth : imageHeight;
+    byte b = (imageHeader & 1) ? value >> 8 : value;
+    imageHeader++;
+    return b;
+  }
+
+  if (imageByte == 0) {
+    // Start the next run, find how many following pixels share its color
+    if (imageX >= imageWidth) {
+      imagePixels = NULL;
+      return -1;
+    }
+    imageColor = pgm_read_word(imageNext);
+    imageRun = 1;
+    nextImagePixel();
+    while (imageRun < RLE_MAX_RUN && imageX < imageWidth
+        && pgm_read_word(imageNext) == imageColor) {
+      imageRun++;
+      nextImagePixel();
+    }
+  }
+
+  byte b;
+  if (imageByte == 0) {
+    b = imageRun - 1;
+  }
+  else if (imageByte == 1) {
+    b = imageColor >> 8;
+  }
+  else {
+    b = imageColor;
+  }
+  imageByte = (imageByte + 1) % RLE_RUN_SIZE;
+  return b;
+}
+
+void Sender::sleepUntilButton() {
+  #ifdef USE_ARDUINO
+  /*
+  Analog comparator can't wake the MCU from power-down, so sleep in idle.
+  ADC is off (the comparator needs it off to use the ADC multiplexer).
+  Timer 0 keeps running, so millis() and the debounce stay right. Its tick
+  wakes the MCU every 1ms for a few us, then it goes straight back to sleep.
+  Idle wakes in a few clock cycles, the first ADC reading after wake-up
+  takes ~200us, so the press is decoded well under 1ms.
+  */
+  byte adcsra = ADCSRA;
+  ADCSRA &= ~_BV(ADEN);
+  ADCSRB |= _BV(ACME); // Negative comparator input from the ADC multiplexer
+  ADMUX = (ADMUX & 0xF0) | ((btnPin - A0) & 0x0F);
+  DIDR1 |= _BV(AIN0D); // AIN0 is analog only, save the digital input buffer
+  ACSR = _BV(ACI) | _BV(ACIS1); // AIN0 reference, interrupt on falling output
+  delayMicroseconds(2); // Comparator output settles
+
+  cli();
+  if (ACSR & _BV(ACO)) { // Reference above the button input, nothing pressed
+    ACSR = (ACSR & ~_BV(ACI)) | _BV(ACIE); // Writing ACI back as 1 would clear a pending edge
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_enable();
+    while (ACSR & _BV(ACIE)) { // Cleared by the comparator interrupt only
+      sei(); // Next instruction runs before any interrupt, so no wake-up is lost
+      sleep_cpu();
+      cli();
+    }
+    sleep_disable();
+    wakeMicros = micros();
+    wakePending = true;
+  }
+  sei();
+
+  ACSR = _BV(ACD) | _BV(ACI); // Comparator off
+  ADCSRB &= ~_BV(ACME);
+  ADCSRA = adcsra;
+  #endif
+}
+
 void Sender::start() {
   unsigned long previousMillis = 0;
 
@@ -58,8 +218,15 @@ void Sender::start() {
     int btnValue = analogRead(btnPin);
     if (isKeyboardButtonPressed(currentMillis, previousMillis, btnValue)) {
       checkKeyboard(btnValue);
+      if (wakePending) {
+        wakeLatency = micros() - wakeMicros; // Includes any wait for the debounce
+        wakePending = false;
+      }
       protocolMethod();
       previousMillis = currentMillis;
     }
+    else if (lowPower && btnValue <= btnThreshold) {
+      sleepUntilButton();
+    }
   }
 }
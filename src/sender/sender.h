@@ -5,6 +5,8 @@
 #define USE_ARDUINO
 
 #include "Arduino.h"
+#include "fountain.h"
+#include "rle.h"
 
 typedef void (*FunctionPointer)();
 
@@ -57,6 +59,59 @@ class Sender {
     */
     void setButtonThreshold(int16_t threshold);
 
+    /*!
+      @brief   Sets the data for fountain-coded bulk transfer.
+      @details The data isn't copied, the buffer must stay valid while transmitting.
+               Restarts the coded stream from the first packet.
+      @param   data Data to be transmitted.
+      @param   length Data length in bytes (1 - FOUNTAIN_MAX_LENGTH).
+      @return  True if the data fits into the fountain block budget.
+    */
+    bool setFountainData(const byte* data, uint16_t length);
+
+    /*!
+      @brief   Builds the next packet of the endless fountain-coded stream.
+      @details Bulk on the reciver recovers the data from slightly more packets
+               than source blocks, in any order, so keep sending until it is done.
+      @param   packet Array to store the packet (size FOUNTAIN_PACKET_SIZE).
+      @return  False if no fountain data is set.
+    */
+    bool nextFountainPacket(byte packet[FOUNTAIN_PACKET_SIZE]);
+
+    /*!
+      @brief   Sets the image for run-length encoded transfer.
+      @details The image isn't copied, pixels are read from PROGMEM while encoding.
+      @param   pixels RGB565 pixels in PROGMEM, row by row.
+      @param   width Image width.
+      @param   height Image height.
+      @return  False if the image is empty.
+    */
+    bool setImage(const uint16_t* pixels, uint16_t width, uint16_t height);
+
+    /*!
+      @brief   Gets the next byte of the encoded image stream.
+      @details Encodes on the fly, one run at a time, no buffer for the image.
+      @return  The next byte, -1 when the whole image has been read.
+    */
+    int16_t nextImageByte();
+
+    /*!
+      @brief   Enables sleeping while no button is pressed.
+      @details Arduino only. The MCU sleeps in idle mode with ADC off and wakes
+               on the analog comparator when the button input rises above
+               the wake reference on D6 (AIN0). Set the reference between
+               the released level and the lowest button level, e.g. ~0.2V.
+               The internal 1.1V reference is above button 1, so it isn't used.
+      @param   enable True to sleep between presses.
+    */
+    void setLowPower(bool enable) { lowPower = enable; }
+
+    /*!
+      @brief   Gets the time from the last wake-up to the start of transmitting.
+      @return  (us) Wake-to-first-bit latency, 0 if not measured yet.
+    */
+    unsigned long getWakeLatency() { return wakeLatency; }
+
     /*!
       @brief   Starts the Sender functionality.
     */
@@ -85,9 +140,43 @@ class Sender {
     const int16_t debounceDelay = 400; // (ms) Time to prevent button blocking
     int16_t btnThreshold = 50; // 50 - minimum threshold for a pressed button (this value can be changed)
 
+    /*--- Low power ---*/
+    bool lowPower = false;
+    bool wakePending = false; // Woken up, nothing transmitted yet
+    unsigned long wakeMicros = 0; // (us) Time of the last wake-up
+    unsigned long wakeLatency = 0; // (us) Last wake-to-first-bit latency
+
+    /*!
+      @brief   Sleeps until a button is pressed.
+      @details Returns right away if the button is already pressed.
+    */
+    void sleepUntilButton();
+
     String transmittedData[5] = { "Message 1", "Message 2", "Message 3", "Message 4", "Message 5" };
     String transmittedText = transmittedData[0];
 
+    /*--- Fountain transfer ---*/
+    const byte* fountainData = NULL;
+    uint16_t fountainLength = 0;
+    uint16_t fountainSeed = 0; // Seed of the next coded packet
+
+    /*--- Image transfer ---*/
+    const uint16_t* imagePixels = NULL;
+    uint16_t imageWidth = 0;
+    uint16_t imageHeight = 0;
+    uint16_t imageX = 0; // Position of the next pixel to encode
+    uint16_t imageY = 0;
+    const uint16_t* imageNext = NULL; // Address of the next pixel to encode
+    uint16_t imageColor = 0; // Color of the current run
+    uint16_t imageRun = 0; // Length of the current run
+    uint8_t imageHeader = 0; // Header bytes already read
+    uint8_t imageByte = 0; // Next byte of the current run
+
+    /*!
+      @brief   Moves to the next pixel in the stream order (column by column, top down).
+    */
+    void nextImagePixel();
+
     /*!
       @brief   Changes the transmitted text based on the index.
       @param   index Index of the message in the transmitted data array.
@@ -4,6 +4,11 @@ Sender sender; // Create an instance of the Sender class
 
 void sendData() {
   // Your transmitted protocol here
+  // Send images, e.g. sender.setImage(icon, 16, 16) and sender.nextImageByte() until -1
+
+  // Print after transmitting, so printing doesn't delay the first bit
+  Serial.print("Wake latency (us): ");
+  Serial.println(sender.getWakeLatency()); // 0 until the first wake-up from low power
 }
 
 void setup() {
@@ -15,6 +20,7 @@ void setup() {
     { "Data 1", "Data 2", "Data 3", "Data 4", "Data 5" }; // Custom transmitted data
   sender.setTransmittedData(newData); // Set custom transmitted data
   sender.useProtocol(sendData); // Set custom method to send data
+  //sender.setLowPower(true); // Sleep between presses, needs wake reference on D6 (see sender.h)
   /*---- End of setup ----*/
 }
 
@@ -0,0 +1,47 @@
+#ifndef ARDUINO_STUB_H_INCLUDED
+#define ARDUINO_STUB_H_INCLUDED
+
+// Minimal host stand-in for the Arduino core, just enough to build
+// Sender and Bulk for bulk_verify.cpp. Pins and registers do nothing.
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+typedef uint8_t byte;
+typedef std::string String;
+
+#define INPUT 0
+#define OUTPUT 1
+#define LOW 0
+#define HIGH 1
+#define A0 14
+#define A5 19
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int analogRead(int) { return 0; }
+inline unsigned long millis() { return 0; }
+inline unsigned long micros() { return 0; }
+inline void delayMicroseconds(unsigned int) {}
+
+#define PROGMEM
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+
+// AVR registers used by Sender::sleepUntilButton()
+inline uint8_t ACSR, ADCSRA, ADCSRB, ADMUX, DIDR1;
+#define _BV(bit) (1 << (bit))
+#define ACD 7
+#define ACBG 6
+#define ACO 5
+#define ACI 4
+#define ACIE 3
+#define ACIS1 1
+#define ADEN 7
+#define ACME 6
+#define AIN0D 1
+#define ISR(vector) void vector()
+inline void cli() {}
+inline void sei() {}
+
+#endif // ARDUINO_STUB_H_INCLUDED
@@ -0,0 +1,12 @@
+#ifndef AVR_SLEEP_STUB_H_INCLUDED
+#define AVR_SLEEP_STUB_H_INCLUDED
+
+// Host stand-in for <avr/sleep.h>, see ../Arduino.h
+
+#define SLEEP_MODE_IDLE 0
+inline void set_sleep_mode(int) {}
+inline void sleep_enable() {}
+inline void sleep_disable() {}
+inline void sleep_cpu() {}
+
+#endif // AVR_SLEEP_STUB_H_INCLUDED
@@ -0,0 +1,123 @@
+/*
+  Host-side verifier of the fountain-coded bulk transfer.
+
+  Runs Sender::nextFountainPacket() -> simulated channel -> Bulk::addPacket()
+  for several data lengths, loss rates and channel modes, checks the recovered
+  data and prints the overhead: valid packets received above the number of
+  source blocks. Fails if a transfer doesn't decode, or the overhead goes
+  over MAX_OVERHEAD in one run or MAX_AVG_OVERHEAD on average.
+
+  Channel modes:
+  start   -- reciver listens from the first (systematic) packet
+  join    -- reciver joins mid-stream, after up to MAX_JOIN packets
+  reorder -- joins mid-stream, packets are shuffled in groups of REORDER_WINDOW
+  corrupt -- joins mid-stream, CORRUPT_RATE % of packets get one flipped bit
+
+  Build and run from the repository root:
+  g++ -Itest/bulk -Isrc/sender -Isrc/reciver test/bulk/bulk_verify.cpp \
+      src/sender/sender.cpp src/reciver/bulk.cpp -o bulk_verify && ./bulk_verify
+*/
+
+#include "sender.h"
+#include "bulk.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+const uint16_t LENGTHS[] = { 1, 16, 17, 100, 256, 333, 480, 511, 512 };
+const uint8_t LOSSES[] = { 0, 10, 30, 50 }; // (%) Lost packets
+const char* MODES[] = { "start", "join", "reorder", "corrupt" };
+const uint16_t RUNS = 500; // Transfers per length, loss and mode
+const uint16_t MAX_JOIN = 2000; // Max packets sent before the reciver joins
+const uint8_t REORDER_WINDOW = 16; // Packets shuffled together
+const uint8_t CORRUPT_RATE = 5; // (%) Packets with a flipped bit
+const uint32_t MAX_SENT = 100000; // Give up, the decoder is stuck
+const uint16_t MAX_OVERHEAD = 24; // Extra packets allowed in one transfer
+const double MAX_AVG_OVERHEAD = 2.5; // Extra packets allowed on average
+
+enum Mode { START, JOIN, REORDER, CORRUPT };
+
+int main() {
+  bool ok = true;
+  printf("length blocks loss%%  mode     avg overhead  max overhead  avg sent\n");
+  for (uint16_t length : LENGTHS) {
+    for (uint8_t loss : LOSSES) {
+      for (uint8_t mode = START; mode <= CORRUPT; mode++) {
+        uint32_t overheadSum = 0;
+        uint16_t overheadMax = 0;
+        uint32_t sentSum = 0;
+        uint8_t blocks = fountainBlockCount(length);
+        for (uint16_t run = 0; run < RUNS; run++) {
+          srand(run * 7919 + length * 31 + loss * 3 + mode);
+          static byte data[FOUNTAIN_MAX_LENGTH];
+          for (uint16_t i = 0; i < length; i++) {
+            data[i] = rand();
+          }
+
+          // Fresh instances, like after a reset of both boards
+          Sender sender;
+          Bulk bulk;
+          bulk.init();
+          sender.setFountainData(data, length);
+
+          byte window[REORDER_WINDOW][FOUNTAIN_PACKET_SIZE];
+          uint8_t windowSize = mode == REORDER ? REORDER_WINDOW : 1;
+          if (mode != START) {
+            for (uint16_t skip = rand() % (MAX_JOIN + 1); skip > 0; skip--) {
+              sender.nextFountainPacket(window[0]);
+            }
+          }
+
+          uint32_t sent = 0;
+          bool done = false;
+          while (!done && sent < MAX_SENT) {
+            for (uint8_t i = 0; i < windowSize; i++) {
+              sender.nextFountainPacket(window[i]);
+            }
+            sent += windowSize;
+            for (uint8_t i = windowSize - 1; i > 0; i--) {
+              uint8_t j = rand() % (i + 1);
+              byte tmp[FOUNTAIN_PACKET_SIZE];
+              memcpy(tmp, window[i], FOUNTAIN_PACKET_SIZE);
+              memcpy(window[i], window[j], FOUNTAIN_PACKET_SIZE);
+              memcpy(window[j], tmp, FOUNTAIN_PACKET_SIZE);
+            }
+            for (uint8_t i = 0; i < windowSize && !done; i++) {
+              if (rand() % 100 < loss) {
+                continue;
+              }
+              if (mode == CORRUPT && rand() % 100 < CORRUPT_RATE) {
+                window[i][rand() % FOUNTAIN_PACKET_SIZE] ^= 1 << (rand() % 8);
+              }
+              done = bulk.addPacket(window[i]);
+            }
+          }
+
+          if (!done || bulk.getLength() != length || memcmp(bulk.getData(), data, length) != 0) {
+            printf("FAIL length %u loss %u%% mode %s run %u: not decoded\n", length, loss, MODES[mode], run);
+            ok = false;
+            continue;
+          }
+          uint16_t overhead = bulk.getPacketCount() - blocks;
+          if (overhead > MAX_OVERHEAD) {
+            printf("FAIL length %u loss %u%% mode %s run %u: overhead %u\n", length, loss, MODES[mode], run, overhead);
+            ok = false;
+          }
+          overheadSum += overhead;
+          if (overhead > overheadMax) {
+            overheadMax = overhead;
+          }
+          sentSum += sent;
+        }
+        double overheadAvg = (double)overheadSum / RUNS;
+        printf("%6u %6u %5u  %-7s  %12.2f  %12u  %8.1f\n", length, blocks, loss, MODES[mode],
+          overheadAvg, overheadMax, (double)sentSum / RUNS);
+        if (overheadAvg > MAX_AVG_OVERHEAD) {
+          printf("FAIL length %u loss %u%% mode %s: average overhead %.2f\n", length, loss, MODES[mode], overheadAvg);
+          ok = false;
+        }
+      }
+    }
+  }
+  printf(ok ? "OK\n" : "FAILED\n");
+  return ok ? 0 : 1;
+}